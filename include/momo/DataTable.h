@@ -451,6 +451,11 @@ public:
 		mIndexes.Reserve(capacity);
 	}
 
+	MemPoolStatistics GetRawMemPoolStatistics() const noexcept
+	{
+		return mRawMemPool.GetStatistics();
+	}
+
 	const ConstRowReference operator[](size_t rowNumber) const
 	{
 		MOMO_CHECK(rowNumber < GetCount());
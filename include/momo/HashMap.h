@@ -514,6 +514,16 @@ public:
 		return mHashSet.IsEmpty();
 	}
 
+	MemPoolStatistics GetMemPoolStatistics() const noexcept
+	{
+		return mHashSet.GetMemPoolStatistics();
+	}
+
+	void Compact()
+	{
+		mHashSet.Compact();
+	}
+
 	void Clear(bool shrink = true) noexcept
 	{
 		mHashSet.Clear(shrink);
@@ -948,6 +948,35 @@ public:
 		return bucketCount;
 	}
 
+	MemPoolStatistics GetMemPoolStatistics() const noexcept
+	{
+		MemPoolStatistics stats;
+		const BucketParams* prevBucketParams = nullptr;
+		for (Buckets* bkts = mBuckets; bkts != nullptr; bkts = bkts->GetNextBuckets())
+		{
+			const BucketParams* bucketParams = &bkts->GetBucketParams();
+			if (bucketParams != prevBucketParams)
+				stats += bucketParams->GetMemPoolStatistics();
+			prevBucketParams = bucketParams;
+		}
+		return stats;
+	}
+
+	void Compact()
+	{
+		if (mBuckets == nullptr)
+			return;
+		internal::NestedArrayIntCap<0, Bucket*, internal::MemManagerPtr<MemManager>> buckets(
+			(internal::MemManagerPtr<MemManager>(GetMemManager())));
+		for (Buckets* bkts = mBuckets; bkts != nullptr; bkts = bkts->GetNextBuckets())
+		{
+			for (Bucket& bucket : *bkts)
+				buckets.AddBack(&bucket);
+		}
+		Bucket::Compact(mBuckets->GetBucketParams(), buckets.GetItems(), buckets.GetCount());
+		mCrew.IncVersion();
+	}
+
 	ConstBucketBounds GetBucketBounds(size_t bucketIndex) const
 	{
 		MOMO_CHECK(bucketIndex < GetBucketCount());
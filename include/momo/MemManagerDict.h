@@ -19,6 +19,7 @@
 
 #include "MemManager.h"
 #include "TreeMap.h"
+#include "HashMap.h"
 
 namespace momo
 {
@@ -33,6 +34,15 @@ namespace internal
 		static const bool checkVersion = false;
 		static const bool allowExceptionSuppression = false;
 	};
+
+	class MemManagerDictBlockHashDictSettings : public HashMapSettings
+	{
+	public:
+		static const CheckMode checkMode = CheckMode::assertion;
+		static const ExtraCheckMode extraCheckMode = ExtraCheckMode::nothing;
+		static const bool checkVersion = false;
+		static const bool allowExceptionSuppression = false;
+	};
 }
 
 class MemManagerDictSettings
@@ -41,7 +51,12 @@ public:
 	static const CheckMode checkMode = CheckMode::bydefault;
 	static const ExtraCheckMode extraCheckMode = ExtraCheckMode::bydefault;
 
+	// `true`: blocks are kept in an open addressing hash map (O(1) allocation and
+	// deallocation, but `FindBlock` for an interior pointer is a linear search)
+	static const bool useHashBlockDict = false;
+
 	typedef TreeNodeDefault BlockDictTreeNode;
+	typedef HashBucketOpenDefault BlockDictHashBucket;
 };
 
 template<typename TBaseMemManager = MemManagerDefault,
@@ -53,14 +68,23 @@ public:
 	typedef TSettings Settings;
 
 private:
+	static const bool useHashBlockDict = Settings::useHashBlockDict;
+
 	typedef TreeTraits<void*, false, typename Settings::BlockDictTreeNode> BlockDictTreeTraits;
+	typedef HashTraits<void*, typename Settings::BlockDictHashBucket> BlockDictHashTraits;
+
+	typedef typename std::conditional<useHashBlockDict,
+		HashMapCore<HashMapKeyValueTraits<void*, size_t, BaseMemManager>,
+			BlockDictHashTraits, internal::MemManagerDictBlockHashDictSettings>,
+		TreeMapCore<TreeMapKeyValueTraits<void*, size_t, BaseMemManager>,
+			BlockDictTreeTraits, internal::MemManagerDictBlockDictSettings>>::type BlockDict;
 
-	typedef TreeMapCore<TreeMapKeyValueTraits<void*, size_t, BaseMemManager>,
-		BlockDictTreeTraits, internal::MemManagerDictBlockDictSettings> BlockDict;
+	typedef typename std::conditional<useHashBlockDict,
+		BlockDictHashTraits, BlockDictTreeTraits>::type BlockDictTraits;
 
 public:
 	explicit MemManagerDict(BaseMemManager baseMemManager = BaseMemManager())
-		: mBlockDict(BlockDictTreeTraits(), std::move(baseMemManager))
+		: mBlockDict(BlockDictTraits(), std::move(baseMemManager))
 	{
 	}
 
@@ -111,7 +135,26 @@ public:
 		GetBaseMemManager().Deallocate(ptr, size);
 	}
 
+	void DeallocateAll() noexcept
+	{
+		BaseMemManager& baseMemManager = GetBaseMemManager();
+		for (auto ref : mBlockDict)
+			baseMemManager.Deallocate(ref.key, ref.value);
+		mBlockDict.Clear();
+	}
+
+	size_t GetBlockCount() const noexcept
+	{
+		return mBlockDict.GetCount();
+	}
+
 	void* FindBlock(void* ptr, size_t* resSize = nullptr) const noexcept
+	{
+		return pvFindBlock(ptr, resSize, internal::BoolConstant<useHashBlockDict>());
+	}
+
+private:
+	void* pvFindBlock(void* ptr, size_t* resSize, std::false_type /*useHashBlockDict*/) const noexcept
 	{
 		auto iter = mBlockDict.GetUpperBound(ptr);
 		if (iter != mBlockDict.GetBegin())
@@ -128,6 +171,29 @@ public:
 		return nullptr;
 	}
 
+	void* pvFindBlock(void* ptr, size_t* resSize, std::true_type /*useHashBlockDict*/) const noexcept
+	{
+		auto iter = mBlockDict.Find(ptr);
+		if (iter != mBlockDict.GetEnd())
+		{
+			if (resSize != nullptr)
+				*resSize = iter->value;
+			return ptr;
+		}
+		uintptr_t uintPtr = internal::PtrCaster::ToUInt(ptr);
+		for (auto ref : mBlockDict)
+		{
+			uintptr_t begin = internal::PtrCaster::ToUInt(ref.key);
+			if (begin <= uintPtr && uintPtr < begin + uintptr_t{ref.value})
+			{
+				if (resSize != nullptr)
+					*resSize = ref.value;
+				return ref.key;
+			}
+		}
+		return nullptr;
+	}
+
 private:
 	BlockDict mBlockDict;
 };
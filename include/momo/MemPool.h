@@ -13,6 +13,7 @@
     class MemPoolParams
     class MemPoolParamsStatic
     class MemPoolSettings
+    class MemPoolStatistics
     class MemPool
 
 \**********************************************************/
@@ -128,6 +129,60 @@ public:
 	static const ExtraCheckMode extraCheckMode = ExtraCheckMode::bydefault;
 };
 
+class MemPoolStatistics
+{
+public:
+	static const size_t maxBlockCount = 127;
+
+public:
+	explicit MemPoolStatistics() noexcept
+		: chunkCount(0),
+		minChunkCount(0),
+		reservedSize(0),
+		allocCount(0),
+		allocSize(0),
+		cachedCount(0),
+		chunkCounts()
+	{
+	}
+
+	MemPoolStatistics& operator+=(const MemPoolStatistics& stats) noexcept
+	{
+		chunkCount += stats.chunkCount;
+		minChunkCount += stats.minChunkCount;
+		reservedSize += stats.reservedSize;
+		allocCount += stats.allocCount;
+		allocSize += stats.allocSize;
+		cachedCount += stats.cachedCount;
+		for (size_t i = 0; i <= maxBlockCount; ++i)
+			chunkCounts[i] += stats.chunkCounts[i];
+		return *this;
+	}
+
+	double GetUtilization() const noexcept
+	{
+		if (reservedSize == 0)
+			return 0.0;
+		return static_cast<double>(allocSize) / static_cast<double>(reservedSize);
+	}
+
+	double GetFragmentation() const noexcept
+	{
+		if (chunkCount == 0)
+			return 0.0;
+		return static_cast<double>(chunkCount - minChunkCount) / static_cast<double>(chunkCount);
+	}
+
+public:
+	size_t chunkCount;
+	size_t minChunkCount;	// chunk count after perfect compaction
+	size_t reservedSize;
+	size_t allocCount;
+	size_t allocSize;
+	size_t cachedCount;
+	size_t chunkCounts[maxBlockCount + 1];	// by used block count, cached blocks included
+};
+
 template<typename TParams = MemPoolParams<>,
 	typename TMemManager = MemManagerDefault,
 	typename TSettings = MemPoolSettings>
@@ -185,6 +240,12 @@ private:
 
 	typedef internal::Byte Byte;
 
+	typedef internal::MemManagerPtr<MemManager> MemManagerPtr;
+
+	typedef internal::NestedArrayIntCap<0, Byte*, MemManagerPtr> Chunks;
+
+	typedef std::array<internal::BitMath::Word, internal::BitMath::GetWordCount(127)> FreeBlockBits;
+
 public:
 	explicit MemPool()	// vs clang
 		: MemPool(MemManager())
@@ -296,6 +357,39 @@ public:
 		return mData.allocCount;
 	}
 
+	MemPoolStatistics GetStatistics() const noexcept
+	{
+		MemPoolStatistics stats;
+		stats.allocCount = mData.allocCount;
+		stats.allocSize = mData.allocCount * Params::blockSize;
+		stats.cachedCount = mCachedCount;
+		if (Params::blockCount > 1)
+		{
+			if (mFreeChunkHead != nullptr)
+			{
+				for (Byte* chunk = mFreeChunkHead; chunk != nullptr; chunk = pvGetNextChunk(chunk))
+					pvGatherStatistics(chunk, stats);
+				for (Byte* chunk = pvGetPrevChunk(mFreeChunkHead); chunk != nullptr;
+					chunk = pvGetPrevChunk(chunk))
+				{
+					pvGatherStatistics(chunk, stats);
+				}
+			}
+			stats.minChunkCount = internal::UIntMath<>::Ceil(mData.allocCount, Params::blockCount)
+				/ Params::blockCount;
+			stats.reservedSize = stats.chunkCount * pvGetChunkSize();
+		}
+		else
+		{
+			stats.chunkCount = mData.allocCount + mCachedCount;
+			stats.minChunkCount = mData.allocCount;
+			stats.reservedSize = stats.chunkCount
+				* ((pvGetAlignmentAddend() == 0) ? pvGetChunkSize0() : pvGetChunkSize1());
+			stats.chunkCounts[1] = stats.chunkCount;
+		}
+		return stats;
+	}
+
 	bool CanDeallocateAll() const noexcept
 	{
 		return Params::blockCount > 1;
@@ -350,6 +444,35 @@ public:
 		}
 	}
 
+	template<typename BlockRelocator>	// void BlockRelocator(void* srcBlock, void* dstBlock) noexcept
+	void Compact(const BlockRelocator& blockRelocator)
+	{
+		if (Params::blockCount == 1)
+			return;
+		if (pvUseCache())
+			pvFlushDeallocate();
+		if (mFreeChunkHead == nullptr)
+			return;
+		Chunks chunks((MemManagerPtr(GetMemManager())));
+		for (Byte* chunk = mFreeChunkHead; chunk != nullptr; chunk = pvGetNextChunk(chunk))
+			chunks.AddBack(chunk);
+		for (Byte* chunk = pvGetPrevChunk(mFreeChunkHead); chunk != nullptr;
+			chunk = pvGetPrevChunk(chunk))
+		{
+			chunks.AddBack(chunk);
+		}
+		auto chunkLess = [this] (Byte* chunk1, Byte* chunk2)
+			{ return pvGetFreeBlockCount(chunk1) < pvGetFreeBlockCount(chunk2); };
+		std::sort(chunks.GetBegin(), chunks.GetEnd(), chunkLess);
+		size_t chunkCount = chunks.GetCount();
+		size_t dstChunkCount = internal::UIntMath<>::Ceil(mData.allocCount, Params::blockCount)
+			/ Params::blockCount;
+		size_t dstChunkIndex = 0;
+		for (size_t i = chunkCount; i > dstChunkCount; --i)
+			pvRelocateBlocks(chunks[i - 1], chunks.GetItems(), dstChunkIndex, blockRelocator);
+		pvRelinkChunks(chunks.GetItems(), chunkCount);
+	}
+
 	void MergeFrom(MemPool& memPool)
 	{
 		if (this == &memPool)
@@ -703,26 +826,124 @@ private:
 	void pvDeleteBlocks(Byte* chunk, const BlockFilter& blockFilter)
 	{
 		int8_t firstBlockIndex = pvGetFirstBlockIndex(chunk);
-		internal::BitMath::Word freeBlockBits[internal::BitMath::GetWordCount(127)] = {};
+		FreeBlockBits freeBlockBits = {};
+		pvGetFreeBlockBits(chunk, freeBlockBits);
+		for (size_t i = 0; i < Params::blockCount; ++i)
+		{
+			if (internal::BitMath::GetBit(freeBlockBits.data(), i))
+				continue;
+			int8_t blockIndex = firstBlockIndex + static_cast<int8_t>(i);
+			Byte* block = pvGetBlock(chunk, blockIndex);
+			if (!blockFilter(static_cast<void*>(block)))
+				continue;
+			pvDeleteBlock(block, chunk, blockIndex);
+			--mData.allocCount;
+		}
+	}
+
+	void pvGetFreeBlockBits(Byte* chunk, FreeBlockBits& freeBlockBits) const noexcept
+	{
+		int8_t firstBlockIndex = pvGetFirstBlockIndex(chunk);
 		ChunkBytes bytes = pvGetChunkBytes(pvGetChunkBytesPosition(chunk));
 		int8_t freeBlockIndex = bytes.firstFreeBlockIndex;
 		for (int8_t i = 0; i < bytes.freeBlockCount; ++i)
 		{
-			internal::BitMath::SetBit(freeBlockBits,
+			internal::BitMath::SetBit(freeBlockBits.data(),
 				static_cast<size_t>(freeBlockIndex - firstBlockIndex));
 			freeBlockIndex = pvGetNextFreeBlockIndex(pvGetBlock(chunk, freeBlockIndex));
 		}
+	}
+
+	size_t pvGetFreeBlockCount(Byte* chunk) const noexcept
+	{
+		return static_cast<size_t>(pvGetChunkBytes(pvGetChunkBytesPosition(chunk)).freeBlockCount);
+	}
+
+	template<typename BlockRelocator>
+	void pvRelocateBlocks(Byte* srcChunk, Byte* const* dstChunks, size_t& dstChunkIndex,
+		const BlockRelocator& blockRelocator) noexcept
+	{
+		int8_t firstBlockIndex = pvGetFirstBlockIndex(srcChunk);
+		FreeBlockBits freeBlockBits = {};
+		pvGetFreeBlockBits(srcChunk, freeBlockBits);
+		Byte* srcBytesPos = pvGetChunkBytesPosition(srcChunk);
 		for (size_t i = 0; i < Params::blockCount; ++i)
 		{
-			if (internal::BitMath::GetBit(freeBlockBits, i))
+			if (internal::BitMath::GetBit(freeBlockBits.data(), i))
 				continue;
-			int8_t blockIndex = firstBlockIndex + static_cast<int8_t>(i);
-			Byte* block = pvGetBlock(chunk, blockIndex);
-			if (!blockFilter(static_cast<void*>(block)))
+			while (pvGetFreeBlockCount(dstChunks[dstChunkIndex]) == 0)
+				++dstChunkIndex;
+			Byte* dstBytesPos = pvGetChunkBytesPosition(dstChunks[dstChunkIndex]);
+			ChunkBytes dstBytes = pvGetChunkBytes(dstBytesPos);
+			Byte* dstBlock = pvGetBlock(dstChunks[dstChunkIndex], dstBytes.firstFreeBlockIndex);
+			dstBytes.firstFreeBlockIndex = pvGetNextFreeBlockIndex(dstBlock);
+			--dstBytes.freeBlockCount;
+			pvSetChunkBytes(dstBytesPos, dstBytes);
+			int8_t srcBlockIndex = firstBlockIndex + static_cast<int8_t>(i);
+			Byte* srcBlock = pvGetBlock(srcChunk, srcBlockIndex);
+			blockRelocator(static_cast<void*>(srcBlock), static_cast<void*>(dstBlock));
+			ChunkBytes srcBytes = pvGetChunkBytes(srcBytesPos);
+			pvSetNextFreeBlockIndex(srcBlock, srcBytes.firstFreeBlockIndex);
+			srcBytes.firstFreeBlockIndex = srcBlockIndex;
+			++srcBytes.freeBlockCount;
+			pvSetChunkBytes(srcBytesPos, srcBytes);
+		}
+	}
+
+	void pvRelinkChunks(Byte* const* chunks, size_t chunkCount) noexcept
+	{
+		Byte* lastChunk = nullptr;
+		Byte* freeChunkHead = nullptr;
+		auto chunkLinker = [this, &lastChunk] (Byte* chunk)
+		{
+			pvSetPrevChunk(chunk, lastChunk);
+			pvSetNextChunk(chunk, nullptr);
+			if (lastChunk != nullptr)
+				pvSetNextChunk(lastChunk, chunk);
+			lastChunk = chunk;
+		};
+		for (size_t i = 0; i < chunkCount; ++i)
+		{
+			if (pvGetFreeBlockCount(chunks[i]) == 0)
+				chunkLinker(chunks[i]);
+		}
+		for (size_t i = 0; i < chunkCount; ++i)
+		{
+			size_t freeBlockCount = pvGetFreeBlockCount(chunks[i]);
+			if (freeBlockCount == 0 || freeBlockCount == Params::blockCount)
 				continue;
-			pvDeleteBlock(block, chunk, blockIndex);
-			--mData.allocCount;
+			chunkLinker(chunks[i]);
+			if (freeChunkHead == nullptr)
+				freeChunkHead = chunks[i];
 		}
+		for (size_t i = 0; i < chunkCount; ++i)
+		{
+			if (pvGetFreeBlockCount(chunks[i]) != Params::blockCount)
+				continue;
+			if (freeChunkHead == nullptr)
+			{
+				chunkLinker(chunks[i]);
+				freeChunkHead = chunks[i];
+			}
+			else if (chunks[i] != freeChunkHead)
+			{
+				pvSetPrevChunk(chunks[i], nullptr);
+				pvSetNextChunk(chunks[i], nullptr);
+			}
+		}
+		mFreeChunkHead = freeChunkHead;
+		for (size_t i = 0; i < chunkCount; ++i)
+		{
+			if (chunks[i] != freeChunkHead && pvGetFreeBlockCount(chunks[i]) == Params::blockCount)
+				pvDeleteChunk(chunks[i]);
+		}
+	}
+
+	void pvGatherStatistics(Byte* chunk, MemPoolStatistics& stats) const noexcept
+	{
+		ChunkBytes bytes = pvGetChunkBytes(pvGetChunkBytesPosition(chunk));
+		++stats.chunkCount;
+		++stats.chunkCounts[Params::blockCount - static_cast<size_t>(bytes.freeBlockCount)];
 	}
 
 	static int8_t pvGetFirstBlockIndex(Byte* chunk) noexcept
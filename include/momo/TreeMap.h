@@ -393,6 +393,16 @@ public:
 		return mTreeSet.IsEmpty();
 	}
 
+	MemPoolStatistics GetMemPoolStatistics() const noexcept
+	{
+		return mTreeSet.GetMemPoolStatistics();
+	}
+
+	void Compact()
+	{
+		mTreeSet.Compact();
+	}
+
 	void Clear() noexcept
 	{
 		mTreeSet.Clear();
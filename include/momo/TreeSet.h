@@ -631,6 +631,21 @@ public:
 		return mCount == 0;
 	}
 
+	MemPoolStatistics GetMemPoolStatistics() const noexcept
+	{
+		if (mNodeParams == nullptr)
+			return MemPoolStatistics();
+		return mNodeParams->GetMemPoolStatistics();
+	}
+
+	void Compact()
+	{
+		if (mNodeParams == nullptr)
+			return;
+		Node::Compact(*mNodeParams, mRootNode);
+		mCrew.IncVersion();
+	}
+
 	void Clear() noexcept
 	{
 		pvDestroy();
@@ -963,22 +978,8 @@ public:
 				dstTreeSet.mCrew.IncVersion();
 				return;
 			}
-			Node* rootNode = nullptr;
-			if (pvIsOrdered(*this, dstTreeSet))
-				rootNode = pvMergeFast(*this, dstTreeSet);
-			else if (pvIsOrdered(dstTreeSet, *this))
-				rootNode = pvMergeFast(dstTreeSet, *this);
-			if (rootNode != nullptr)
-			{
-				dstTreeSet.mCount += mCount;
-				mCount = 0;
-				dstTreeSet.mRootNode = rootNode;
-				mRootNode = nullptr;
-				dstTreeSet.mNodeParams->MergeFrom(*mNodeParams);
-				mCrew.IncVersion();
-				dstTreeSet.mCrew.IncVersion();
+			if (pvMergeFast(dstTreeSet, internal::BoolConstant<Node::isParamsMergeable>()))
 				return;
-			}
 		}
 		if (count * internal::UIntMath<>::Log2(count + dstCount) < count + dstCount)	//?
 			pvMergeTo(dstTreeSet);
@@ -1628,6 +1629,30 @@ private:
 		}
 	}
 
+	bool pvMergeFast(TreeSetCore& dstTreeSet, std::true_type /*isParamsMergeable*/)
+	{
+		Node* rootNode = nullptr;
+		if (pvIsOrdered(*this, dstTreeSet))
+			rootNode = pvMergeFast(*this, dstTreeSet);
+		else if (pvIsOrdered(dstTreeSet, *this))
+			rootNode = pvMergeFast(dstTreeSet, *this);
+		if (rootNode == nullptr)
+			return false;
+		dstTreeSet.mCount += mCount;
+		mCount = 0;
+		dstTreeSet.mRootNode = rootNode;
+		mRootNode = nullptr;
+		dstTreeSet.mNodeParams->MergeFrom(*mNodeParams);
+		mCrew.IncVersion();
+		dstTreeSet.mCrew.IncVersion();
+		return true;
+	}
+
+	bool pvMergeFast(TreeSetCore& /*dstTreeSet*/, std::false_type /*isParamsMergeable*/) noexcept
+	{
+		return false;
+	}
+
 	static Node* pvMergeFast(TreeSetCore& treeSet1, TreeSetCore& treeSet2)
 	{
 		size_t height1 = pvGetHeight(treeSet1.mRootNode);
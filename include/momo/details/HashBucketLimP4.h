@@ -185,6 +185,9 @@ namespace internal
 		typedef BucketLimP4PtrState<Item, useHashCodePartGetter ? 3 : 0,
 			UIntConst::ptrUsefulBitCount> PtrState;
 
+		typedef std::pair<Item*, BucketLimP4*> ItemsBucket;
+		typedef NestedArrayIntCap<0, ItemsBucket, MemManagerPtr> ItemsBuckets;
+
 		MOMO_STATIC_ASSERT(PtrState::bitCount % 8 == 0);
 		static const size_t codeCount = 4 +
 			(useHashCodePartGetter ? sizeof(void*) - PtrState::bitCount / 8 : 0);
@@ -236,6 +239,15 @@ namespace internal
 				return std::get<memPoolIndex - 1>(mMemPools);
 			}
 
+			MemPoolStatistics GetMemPoolStatistics() const noexcept
+			{
+				MemPoolStatistics stats = std::get<0>(mMemPools).GetStatistics();
+				stats += std::get<1>(mMemPools).GetStatistics();
+				stats += std::get<2>(mMemPools).GetStatistics();
+				stats += std::get<3>(mMemPools).GetStatistics();
+				return stats;
+			}
+
 		private:
 			template<size_t memPoolIndex>
 			void pvClear() noexcept
@@ -299,6 +311,24 @@ namespace internal
 			pvSetEmpty(minMemPoolIndex);
 		}
 
+		static void Compact(Params& params, BucketLimP4* const* buckets, size_t count)
+		{
+			MOMO_STATIC_ASSERT(ItemTraits::isNothrowRelocatable);
+			ItemsBuckets itemsBuckets((MemManagerPtr(params.GetMemManager())));
+			itemsBuckets.Reserve(count);
+			for (size_t i = 0; i < count; ++i)
+			{
+				Item* items = buckets[i]->mPtrState.GetPtr();
+				if (items != nullptr)
+					itemsBuckets.AddBackNogrow(ItemsBucket(items, buckets[i]));
+			}
+			std::sort(itemsBuckets.GetBegin(), itemsBuckets.GetEnd(), &pvLessItems);
+			pvCompact<1>(params, itemsBuckets);
+			pvCompact<2>(params, itemsBuckets);
+			pvCompact<3>(params, itemsBuckets);
+			pvCompact<4>(params, itemsBuckets);
+		}
+
 		template<typename ItemCreator>
 		Iterator AddCrt(Params& params, ItemCreator&& itemCreator, size_t hashCode,
 			size_t logBucketCount, size_t probe)
@@ -545,6 +575,32 @@ namespace internal
 				memPool.Deallocate(items);
 		}
 
+		static bool pvLessItems(const ItemsBucket& itemsBucket1,
+			const ItemsBucket& itemsBucket2) noexcept
+		{
+			return std::less<Item*>()(itemsBucket1.first, itemsBucket2.first);
+		}
+
+		template<size_t memPoolIndex>
+		static void pvCompact(Params& params, ItemsBuckets& itemsBuckets) noexcept
+		{
+			MemManager& memManager = params.GetMemManager();
+			auto blockRelocator = [&memManager, &itemsBuckets] (void* srcBlock, void* dstBlock) noexcept
+			{
+				Item* srcItems = static_cast<Item*>(srcBlock);
+				Item* dstItems = static_cast<Item*>(dstBlock);
+				ItemsBucket* itemsBucket = std::lower_bound(itemsBuckets.GetBegin(),
+					itemsBuckets.GetEnd(), ItemsBucket(srcItems, nullptr), &pvLessItems);
+				MOMO_ASSERT(itemsBucket->first == srcItems);
+				BucketLimP4* bucket = itemsBucket->second;
+				size_t itemCount = bucket->pvGetCount();
+				for (size_t i = 0; i < itemCount; ++i)
+					ItemTraits::Relocate(&memManager, srcItems[i], dstItems + i);
+				bucket->pvSetPtrState(dstItems, memPoolIndex);
+			};
+			params.template GetMemPool<memPoolIndex>().Compact(blockRelocator);
+		}
+
 	private:
 		PtrState mPtrState;
 		uint8_t mShortCodes[codeCount];
@@ -49,6 +49,8 @@ namespace internal
 		static const size_t maxCapacity = tMaxCapacity;
 		MOMO_STATIC_ASSERT(0 < maxCapacity && maxCapacity < 256);
 
+		static const bool isParamsMergeable = true;
+
 		typedef typename ItemTraits::Item Item;
 		typedef typename ItemTraits::MemManager MemManager;
 
@@ -127,6 +129,14 @@ namespace internal
 				return mLeafMemPools[leafMemPoolIndex];
 			}
 
+			MemPoolStatistics GetMemPoolStatistics() const noexcept
+			{
+				MemPoolStatistics stats = mInternalMemPool.GetStatistics();
+				for (const LeafMemPool& leafMemPool : mLeafMemPools)
+					stats += leafMemPool.GetStatistics();
+				return stats;
+			}
+
 			void MergeFrom(Params& params) noexcept
 			{
 				mInternalMemPool.MergeFrom(params.mInternalMemPool);
@@ -253,6 +263,26 @@ namespace internal
 			++mCounter.count;
 		}
 
+		static void Compact(Params& params, Node*& rootNode)
+		{
+			MOMO_STATIC_ASSERT(ItemTraits::isNothrowRelocatable);
+			MemManager& memManager = params.GetMemManager();
+			auto leafRelocator = [&memManager, &rootNode] (void* srcBlock, void* dstBlock) noexcept
+			{
+				pvRelocate(memManager, static_cast<Node*>(srcBlock), dstBlock, rootNode);
+			};
+			for (size_t i = 0; i < leafMemPoolCount; ++i)
+				params.GetLeafMemPool(i).Compact(leafRelocator);
+			auto internalRelocator = [&memManager, &rootNode] (void* srcBlock, void* dstBlock) noexcept
+			{
+				Node* srcNode = PtrCaster::FromBytePtr<Node>(
+					PtrCaster::ToBytePtr(srcBlock) + internalOffset);
+				pvRelocate(memManager, srcNode, PtrCaster::ToBytePtr(dstBlock) + internalOffset,
+					rootNode);
+			};
+			params.GetInternalMemPool().Compact(internalRelocator);
+		}
+
 		template<typename ItemRemover>
 		void Remove(Params& params, size_t index, ItemRemover&& itemRemover)
 		{
@@ -288,6 +318,31 @@ namespace internal
 			return leafMemPoolIndex;
 		}
 
+		static void pvRelocate(MemManager& memManager, Node* srcNode, void* dstNodeBuffer,
+			Node*& rootNode) noexcept
+		{
+			size_t count = srcNode->GetCount();
+			Node* dstNode = ::new(dstNodeBuffer) Node(size_t{srcNode->mMemPoolIndex}, count);
+			dstNode->mParent = srcNode->mParent;
+			dstNode->mCounter = srcNode->mCounter;
+			for (size_t i = 0; i < count; ++i)
+				ItemTraits::Relocate(&memManager, *srcNode->GetItemPtr(i), dstNode->GetItemPtr(i));
+			if (!srcNode->IsLeaf())
+			{
+				Node** srcChildren = pvGetChildren(srcNode);
+				Node** dstChildren = pvGetChildren<false>(dstNode);
+				std::uninitialized_copy_n(srcChildren, maxCapacity + 1, dstChildren);
+				for (size_t i = 0; i <= count; ++i)
+					dstChildren[i]->mParent = dstNode;
+			}
+			Node* parent = dstNode->mParent;
+			if (parent != nullptr)
+				parent->SetChild(parent->GetChildIndex(srcNode), dstNode);
+			else
+				rootNode = dstNode;
+			srcNode->~Node();
+		}
+
 		template<bool isWithinLifetime = true,
 			typename QNode>
 		static ConstLike<Node*, QNode>* pvGetChildren(QNode* node) noexcept
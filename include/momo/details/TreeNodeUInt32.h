@@ -0,0 +1,370 @@
+/**********************************************************\
+
+  This file is part of the
+  https://github.com/morzhovets/momo
+  project, distributed under the MIT License. See
+  https://github.com/morzhovets/momo/blob/branch_cpp11/LICENSE
+  for details.
+
+  momo/details/TreeNodeUInt32.h
+
+  namespace momo:
+    class TreeNodeUInt32
+
+\**********************************************************/
+
+#ifndef MOMO_INCLUDE_GUARD_DETAILS_TREE_NODE_UINT32
+#define MOMO_INCLUDE_GUARD_DETAILS_TREE_NODE_UINT32
+
+#include "TreeNode.h"
+
+namespace momo
+{
+
+namespace internal
+{
+	template<typename TItemTraits, size_t tMaxCapacity, size_t tMemPoolBlockCount,
+		bool tIsFlatLayout>
+	class NodeUInt32
+	{
+	protected:
+		typedef TItemTraits ItemTraits;
+
+		static const size_t memPoolBlockCount = tMemPoolBlockCount;
+
+		static const bool isFlatLayout = tIsFlatLayout;
+		MOMO_STATIC_ASSERT(!isFlatLayout || ItemTraits::isNothrowShiftable);
+
+	public:
+		static const size_t maxCapacity = tMaxCapacity;
+		MOMO_STATIC_ASSERT(0 < maxCapacity && maxCapacity < 256);
+
+		static const bool isParamsMergeable = false;
+
+		typedef typename ItemTraits::Item Item;
+		typedef typename ItemTraits::MemManager MemManager;
+
+	private:
+		typedef BoolConstant<isFlatLayout> IsFlatLayout;
+
+		template<size_t capacity = maxCapacity, size_t indexCount = isFlatLayout ? 0 : capacity>
+		struct Counter
+		{
+			uint8_t count;
+			uint8_t indexes[indexCount];
+		};
+
+		template<size_t capacity>
+		struct Counter<capacity, 0>
+		{
+			uint8_t count;
+		};
+
+		typedef internal::MemManagerPtr<MemManager> MemManagerPtr;
+
+		typedef MemPoolUInt32<memPoolBlockCount, MemManagerPtr> MemPool;
+
+		static const uint32_t nullHandle = MemPool::nullPtr;
+		static const uint32_t internalHandleFlag = uint32_t{1} << 31;
+
+		static const size_t maxMemPoolBlockCount = (size_t{1} << 31) - 1;
+
+		static const size_t internalOffset = UIntMath<>::Ceil(
+			(maxCapacity + 1) * sizeof(uint32_t), UIntConst::maxAlignment);
+
+	public:
+		class Params
+		{
+		private:
+			static const size_t itemOffset = UIntMath<>::Ceil(sizeof(NodeUInt32), ItemTraits::alignment);
+			static const size_t leafNodeSize = UIntMath<>::Ceil(
+				itemOffset + maxCapacity * sizeof(Item), UIntConst::maxAlignment);
+			static const size_t internalNodeSize = internalOffset + leafNodeSize;
+
+		public:
+			explicit Params(MemManager& memManager)
+				: mLeafMemPool(leafNodeSize, MemManagerPtr(memManager), maxMemPoolBlockCount),
+				mInternalMemPool(internalNodeSize, MemManagerPtr(memManager), maxMemPoolBlockCount)
+			{
+			}
+
+			Params(const Params&) = delete;
+
+			~Params() = default;
+
+			Params& operator=(const Params&) = delete;
+
+			MemManager& GetMemManager() noexcept
+			{
+				return mLeafMemPool.GetMemManager().GetBaseMemManager();
+			}
+
+			MemPool& GetLeafMemPool() noexcept
+			{
+				return mLeafMemPool;
+			}
+
+			MemPool& GetInternalMemPool() noexcept
+			{
+				return mInternalMemPool;
+			}
+
+		private:
+			MemPool mLeafMemPool;
+			MemPool mInternalMemPool;
+		};
+
+	public:
+		NodeUInt32() = delete;
+
+		NodeUInt32(const NodeUInt32&) = delete;
+
+		NodeUInt32& operator=(const NodeUInt32&) = delete;
+
+		static NodeUInt32* Create(Params& params, bool isLeaf, size_t count)
+		{
+			MOMO_ASSERT(count <= maxCapacity);
+			if (isLeaf)
+			{
+				uint32_t handle = params.GetLeafMemPool().Allocate();
+				void* nodeBuffer = params.GetLeafMemPool().GetRealPointer(handle);
+				return ::new(nodeBuffer) NodeUInt32(params, handle, count);
+			}
+			else
+			{
+				uint32_t handle = params.GetInternalMemPool().Allocate();
+				Byte* internalBuffer = params.GetInternalMemPool().template GetRealPointer<Byte>(handle);
+				std::uninitialized_fill_n(PtrCaster::FromBytePtr<uint32_t, false>(internalBuffer),
+					maxCapacity + 1, uint32_t{nullHandle});
+				void* nodeBuffer = internalBuffer + internalOffset;
+				return ::new(nodeBuffer) NodeUInt32(params, handle | internalHandleFlag, count);
+			}
+		}
+
+		void Destroy(Params& params) noexcept
+		{
+			uint32_t handle = mHandle;
+			this->~NodeUInt32();
+			if ((handle & internalHandleFlag) == 0)
+				params.GetLeafMemPool().Deallocate(handle);
+			else
+				params.GetInternalMemPool().Deallocate(handle & ~internalHandleFlag);
+		}
+
+		bool IsLeaf() const noexcept
+		{
+			return (mHandle & internalHandleFlag) == 0;
+		}
+
+		size_t GetCapacity() const noexcept
+		{
+			return maxCapacity;
+		}
+
+		size_t GetCount() const noexcept
+		{
+			return size_t{mCounter.count};
+		}
+
+		NodeUInt32* GetParent() noexcept
+		{
+			return pvGetNode(mParent);
+		}
+
+		void SetParent(NodeUInt32* parent) noexcept
+		{
+			mParent = (parent != nullptr) ? parent->mHandle : uint32_t{nullHandle};
+		}
+
+		NodeUInt32* GetChild(size_t index) noexcept
+		{
+			MOMO_ASSERT(index <= GetCount());
+			return pvGetNode(pvGetChildren(this)[index]);
+		}
+
+		void SetChild(size_t index, NodeUInt32* child) noexcept
+		{
+			MOMO_ASSERT(index <= GetCount());
+			pvGetChildren(this)[index] = (child != nullptr) ? child->mHandle : uint32_t{nullHandle};
+		}
+
+		size_t GetChildIndex(const NodeUInt32* child) const noexcept
+		{
+			size_t count = GetCount();
+			const uint32_t* children = pvGetChildren(this);
+			size_t index = UIntMath<>::Dist(children,
+				std::find(children, children + count + 1, child->mHandle));
+			MOMO_ASSERT(index <= count);
+			return index;
+		}
+
+		Item* GetItemPtr(size_t index) noexcept
+		{
+			static const size_t itemOffset = UIntMath<>::Ceil(sizeof(NodeUInt32), ItemTraits::alignment);
+			Item* items = PtrCaster::FromBytePtr<Item>(PtrCaster::ToBytePtr(this) + itemOffset);
+			return pvGetItemPtr(items, index, IsFlatLayout());
+		}
+
+		void AcceptBackItem(Params& params, size_t index) noexcept
+		{
+			size_t count = GetCount();
+			MOMO_ASSERT(count < GetCapacity());
+			MOMO_ASSERT(index <= count);
+			pvAcceptBackItem(params, index, count, IsFlatLayout());
+			if (!IsLeaf())
+			{
+				uint32_t* children = pvGetChildren(this);
+				std::copy_backward(children + index + 1, children + count + 1,
+					children + count + 2);
+			}
+			++mCounter.count;
+		}
+
+		template<typename ItemRemover>
+		void Remove(Params& params, size_t index, ItemRemover&& itemRemover)
+		{
+			size_t count = GetCount();
+			MOMO_ASSERT(index < count);
+			pvRemove(params, index, count, std::forward<ItemRemover>(itemRemover), IsFlatLayout());
+			if (!IsLeaf())
+			{
+				uint32_t* children = pvGetChildren(this);
+				std::copy(children + index + 1, children + count + 1, children + index);
+			}
+			--mCounter.count;
+		}
+
+	private:
+		explicit NodeUInt32(Params& params, uint32_t handle, size_t count) noexcept
+			: mParams(&params),
+			mHandle(handle),
+			mParent(nullHandle)
+		{
+			mCounter.count = static_cast<uint8_t>(count);
+			pvInitIndexes(IsFlatLayout());
+		}
+
+		~NodeUInt32() = default;
+
+		NodeUInt32* pvGetNode(uint32_t handle) const noexcept
+		{
+			if (handle == nullHandle)
+				return nullptr;
+			if ((handle & internalHandleFlag) == 0)
+				return mParams->GetLeafMemPool().template GetRealPointer<NodeUInt32>(handle);
+			Byte* internalBuffer = mParams->GetInternalMemPool().template GetRealPointer<Byte>(
+				handle & ~internalHandleFlag);
+			return PtrCaster::FromBytePtr<NodeUInt32>(internalBuffer + internalOffset);
+		}
+
+		template<typename QNode>
+		static ConstLike<uint32_t, QNode>* pvGetChildren(QNode* node) noexcept
+		{
+			MOMO_ASSERT(!node->IsLeaf());
+			return PtrCaster::FromBytePtr<uint32_t>(PtrCaster::ToBytePtr(node) - internalOffset);
+		}
+
+		void pvInitIndexes(std::true_type /*isFlatLayout*/) noexcept
+		{
+		}
+
+		void pvInitIndexes(std::false_type /*isFlatLayout*/) noexcept
+		{
+			for (size_t i = 0; i < maxCapacity; ++i)
+				mCounter.indexes[i] = static_cast<uint8_t>(i);
+		}
+
+		Item* pvGetItemPtr(Item* items, size_t index, std::true_type /*isFlatLayout*/) noexcept
+		{
+			return items + index;
+		}
+
+		Item* pvGetItemPtr(Item* items, size_t index, std::false_type /*isFlatLayout*/) noexcept
+		{
+			return items + mCounter.indexes[index];
+		}
+
+		void pvAcceptBackItem(Params& params, size_t index, size_t count,
+			std::true_type /*isFlatLayout*/) noexcept
+		{
+			ItemTraits::ShiftNothrow(params.GetMemManager(),
+				std::reverse_iterator<Item*>(GetItemPtr(count + 1)), count - index);
+		}
+
+		void pvAcceptBackItem(Params& /*params*/, size_t index, size_t count,
+			std::false_type /*isFlatLayout*/) noexcept
+		{
+			uint8_t realIndex = mCounter.indexes[count];
+			std::copy_backward(mCounter.indexes + index, mCounter.indexes + count,
+				mCounter.indexes + count + 1);
+			mCounter.indexes[index] = realIndex;
+		}
+
+		template<typename ItemRemover>
+		void pvRemove(Params& params, size_t index, size_t count, ItemRemover&& itemRemover,
+			std::true_type /*isFlatLayout*/)
+		{
+			ItemTraits::ShiftNothrow(params.GetMemManager(), GetItemPtr(index), count - index - 1);
+			std::reverse_iterator<Item*> revIter(GetItemPtr(count));
+			auto fin = Catcher::Finalize(&ItemTraits::template ShiftNothrow<decltype(revIter)>,
+				params.GetMemManager(), revIter, count - index - 1);
+			std::forward<ItemRemover>(itemRemover)(*GetItemPtr(count - 1));
+			fin.Detach();
+		}
+
+		template<typename ItemRemover>
+		void pvRemove(Params& /*params*/, size_t index, size_t count, ItemRemover&& itemRemover,
+			std::false_type /*isFlatLayout*/)
+		{
+			std::forward<ItemRemover>(itemRemover)(*GetItemPtr(index));
+			uint8_t realIndex = mCounter.indexes[index];
+			std::copy(mCounter.indexes + index + 1, mCounter.indexes + count,
+				mCounter.indexes + index);
+			mCounter.indexes[count - 1] = realIndex;
+		}
+
+	private:
+		//uint32_t[maxCapacity + 1] // for internal nodes
+		Params* mParams;
+		uint32_t mHandle;
+		uint32_t mParent;
+		Counter<> mCounter;
+		//Item[]
+	};
+}
+
+/*!
+	Tree node which links children and parent by 32-bit block handles of
+	`MemPoolUInt32` instead of pointers. Internal nodes become about twice
+	smaller, the total node count is limited by 2^31 for leaves and for
+	internal nodes separately.
+	Merging of trees is done item by item, `Compact` is not supported.
+*/
+
+template<size_t tMaxCapacity = 32,
+	size_t tMemPoolBlockCount = 64,
+	bool tIsFlatLayout = true>
+class TreeNodeUInt32
+{
+public:
+	static const size_t maxCapacity = tMaxCapacity;
+	static const size_t memPoolBlockCount = tMemPoolBlockCount;
+	static const bool isFlatLayout = tIsFlatLayout;
+
+	template<typename ItemTraits>
+	using Node = internal::NodeUInt32<ItemTraits, maxCapacity, memPoolBlockCount,
+		isFlatLayout && ItemTraits::isNothrowShiftable>;
+
+public:
+	static size_t GetSplitItemIndex(size_t itemCount, size_t newItemIndex) noexcept
+	{
+		size_t splitItemIndex = itemCount / 2;
+		if (itemCount % 2 == 0 && splitItemIndex > newItemIndex)
+			--splitItemIndex;
+		return splitItemIndex;
+	}
+};
+
+} // namespace momo
+
+#endif // MOMO_INCLUDE_GUARD_DETAILS_TREE_NODE_UINT32
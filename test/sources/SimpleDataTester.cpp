@@ -306,6 +306,13 @@ public:
 		}
 		assert(table.GetCount() == count);
 
+		{
+			momo::MemPoolStatistics stats = table.GetRawMemPoolStatistics();
+			assert(stats.allocCount >= count);
+			assert(stats.allocSize >= count * table.GetColumnList().GetTotalSize());
+			assert(stats.minChunkCount <= stats.chunkCount);
+		}
+
 		assert(table.SelectEmpty().IsEmpty());
 		assert(ctable.SelectEmpty().IsEmpty());
 
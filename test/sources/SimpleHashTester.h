@@ -95,6 +95,69 @@ public:
 		std::cout << "ok" << std::endl;
 	}
 
+	template<typename HashBucket>
+	static void TestMemPoolStatistics(const char* bucketName)
+	{
+		std::cout << bucketName << ": HashSet (MemPoolStatistics): " << std::flush;
+
+		typedef momo::HashSet<size_t, momo::HashTraits<size_t, HashBucket>> HashSet;
+
+		static const size_t count = 1024;
+
+		HashSet set;
+		assert(set.GetMemPoolStatistics().chunkCount == 0);
+		for (size_t i = 0; i < count; ++i)
+			set.Insert(i);
+		momo::MemPoolStatistics stats = set.GetMemPoolStatistics();
+		assert(stats.allocSize >= count * sizeof(size_t));
+		assert(stats.minChunkCount > 0 && stats.minChunkCount <= stats.chunkCount);
+
+		momo::HashMap<size_t, size_t, momo::HashTraits<size_t, HashBucket>> map;
+		for (size_t i = 0; i < count; ++i)
+			map.Insert(i, i);
+		assert(map.GetMemPoolStatistics().allocCount > 0);
+
+		set.Clear(true);
+		assert(set.GetMemPoolStatistics().chunkCount == 0);
+
+		std::cout << "ok" << std::endl;
+	}
+
+	template<typename HashBucket>
+	static void TestCompact(const char* bucketName)
+	{
+		std::cout << bucketName << ": HashMap (Compact): " << std::flush;
+
+		typedef momo::HashMap<size_t, std::string, momo::HashTraits<size_t, HashBucket>> HashMap;
+
+		static const size_t count = 4096;
+
+		HashMap map;
+		map.Compact();
+		for (size_t i = 0; i < count; ++i)
+			map.Insert(i, std::to_string(i));
+		for (size_t i = 0; i < count; ++i)
+		{
+			if (i % 3 != 0)
+				map.Remove(i);
+		}
+		momo::MemPoolStatistics stats = map.GetMemPoolStatistics();
+		map.Compact();
+		momo::MemPoolStatistics newStats = map.GetMemPoolStatistics();
+		assert(newStats.allocCount == stats.allocCount);
+		assert(newStats.chunkCount < stats.chunkCount);
+		assert(newStats.GetFragmentation() < stats.GetFragmentation());
+		assert(map.GetCount() == (count + 2) / 3);
+		for (size_t i = 0; i < count; i += 3)
+			assert(map[i] == std::to_string(i));
+		for (size_t i = 1; i < count; i += 3)
+			map.Insert(i, std::to_string(i));
+		for (size_t i = 0; i < count; ++i)
+			assert(map.ContainsKey(i) == (i % 3 != 2));
+
+		std::cout << "ok" << std::endl;
+	}
+
 	template<typename HashTraits>
 	static void TestStrHashSet()
 	{
@@ -25,6 +25,8 @@ static int testSimpleHash = []
 {
 	SimpleHashTester::TestStrHash<momo::HashBucketLimP4<>>("momo::HashBucketLimP4<>");
 	SimpleHashTester::TestStrHash<momo::HashBucketLimP4<1>>("momo::HashBucketLimP4<1>");
+	SimpleHashTester::TestMemPoolStatistics<momo::HashBucketLimP4<>>("momo::HashBucketLimP4<>");
+	SimpleHashTester::TestCompact<momo::HashBucketLimP4<>>("momo::HashBucketLimP4<>");
 
 	SimpleHashTester::TestTemplHashSet<BUCKET(1, 16),  1, 1>("momo::HashBucketLimP4<1, 16>");
 	SimpleHashTester::TestTemplHashSet<BUCKET(1, 99),  2, 1>("momo::HashBucketLimP4<1, 99>");
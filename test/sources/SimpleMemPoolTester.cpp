@@ -28,6 +28,125 @@ public:
 	{
 		std::mt19937 mt;
 		TestTemplMemPool0(mt);
+		TestStatistics();
+		TestMemManagerDict<false>();
+		TestMemManagerDict<true>();
+	}
+
+	template<bool useHashBlockDict>
+	class MemManagerDictSettings : public momo::MemManagerDictSettings
+	{
+	public:
+		static const bool useHashBlockDict = useHashBlockDict;
+	};
+
+	template<bool useHashBlockDict>
+	static void TestMemManagerDict()
+	{
+		std::cout << "momo::MemManagerDict<useHashBlockDict = " << useHashBlockDict << ">: "
+			<< std::flush;
+
+		typedef momo::MemManagerDict<momo::MemManagerDefault,
+			MemManagerDictSettings<useHashBlockDict>> MemManager;
+		MemManager memManager;
+
+		static const size_t count = 1000;
+		char* blocks[count];
+		for (size_t i = 0; i < count; ++i)
+			blocks[i] = static_cast<char*>(memManager.Allocate(i + 1));
+		assert(memManager.GetBlockCount() == count);
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			size_t size = 0;
+			assert(memManager.FindBlock(blocks[i], &size) == blocks[i]);
+			assert(size == i + 1);
+			assert(memManager.FindBlock(blocks[i] + i) == blocks[i]);
+		}
+
+		for (size_t i = 0; i < count; i += 2)
+			memManager.Deallocate(blocks[i], i + 1);
+		assert(memManager.GetBlockCount() == count / 2);
+		assert(memManager.FindBlock(blocks[1]) == blocks[1]);
+
+		memManager.DeallocateAll();
+		assert(memManager.GetBlockCount() == 0);
+		assert(memManager.FindBlock(blocks[1]) == nullptr);
+
+		std::cout << "ok" << std::endl;
+	}
+
+	static void TestStatistics()
+	{
+		std::cout << "momo::MemPoolStatistics: " << std::flush;
+
+		{
+			momo::MemPool<momo::MemPoolParamsStatic<16, 8, 4, 0>, momo::MemManagerDict<>> memPool;
+			assert(memPool.GetStatistics().chunkCount == 0);
+			assert(memPool.GetStatistics().GetUtilization() == 0.0);
+			assert(memPool.GetStatistics().GetFragmentation() == 0.0);
+
+			void* blocks[16];
+			for (void*& block : blocks)
+				block = memPool.Allocate();
+			momo::MemPoolStatistics stats = memPool.GetStatistics();
+			assert(stats.chunkCount == 5);	// next chunk is preallocated
+			assert(stats.chunkCounts[4] == 4 && stats.chunkCounts[0] == 1);
+			assert(stats.minChunkCount == 4);
+
+			for (size_t i = 0; i < 16; i += 2)
+				memPool.Deallocate(blocks[i]);
+			stats = memPool.GetStatistics();
+			assert(stats.allocCount == 8);
+			assert(stats.allocSize == 8 * 16);
+			assert(stats.cachedCount == 0);
+			assert(stats.chunkCount == 5);
+			assert(stats.minChunkCount == 2);
+			assert(stats.chunkCounts[2] == 4 && stats.chunkCounts[0] == 1);
+			assert(stats.reservedSize >= 5 * 4 * 16);
+			assert(stats.GetFragmentation() == 0.6);
+
+			for (size_t i = 1; i < 16; i += 2)
+				memPool.Deallocate(blocks[i]);
+		}
+
+		{
+			momo::MemPool<momo::MemPoolParamsStatic<16, 8, 4, 4>, momo::MemManagerDict<>> memPool;
+			void* blocks[16];
+			for (void*& block : blocks)
+				block = memPool.Allocate();
+			for (size_t i = 0; i < 16; i += 2)
+				memPool.Deallocate(blocks[i]);
+			momo::MemPoolStatistics stats = memPool.GetStatistics();
+			assert(stats.allocCount == 8);
+			assert(stats.cachedCount == 4);
+			assert(stats.chunkCount == 5);
+			assert(stats.minChunkCount == 2);
+			assert(stats.chunkCounts[2] == 2 && stats.chunkCounts[4] == 2 && stats.chunkCounts[0] == 1);
+			for (size_t i = 1; i < 16; i += 2)
+				memPool.Deallocate(blocks[i]);
+		}
+
+		{
+			momo::MemPool<momo::MemPoolParamsStatic<16, 8, 1, 2>, momo::MemManagerDict<>> memPool;
+			void* blocks[4];
+			for (void*& block : blocks)
+				block = memPool.Allocate();
+			for (size_t i = 0; i < 3; ++i)
+				memPool.Deallocate(blocks[i]);
+			momo::MemPoolStatistics stats = memPool.GetStatistics();
+			assert(stats.allocCount == 1);
+			assert(stats.cachedCount == 1);
+			assert(stats.chunkCount == 2);
+			assert(stats.minChunkCount == 1);
+			assert(stats.chunkCounts[1] == 2);
+			assert(stats.reservedSize == 2 * 16);
+			assert(stats.GetUtilization() == 0.5);
+			assert(stats.GetFragmentation() == 0.5);
+			memPool.Deallocate(blocks[3]);
+		}
+
+		std::cout << "ok" << std::endl;
 	}
 
 	static void TestTemplMemPool0(std::mt19937& mt)
@@ -134,6 +253,43 @@ public:
 				blocks.RemoveBack();
 			}
 			assert(memPool.GetAllocateCount() == lim);
+
+			momo::MemPoolStatistics stats = memPool.GetStatistics();
+			assert(stats.allocCount == lim);
+			assert(stats.allocSize == lim * blockSize);
+			assert(stats.minChunkCount <= stats.chunkCount);
+			assert(stats.reservedSize >= stats.allocSize);
+			size_t chunkCount = 0;
+			size_t usedCount = 0;
+			for (size_t i = 0; i <= momo::MemPoolStatistics::maxBlockCount; ++i)
+			{
+				chunkCount += stats.chunkCounts[i];
+				usedCount += i * stats.chunkCounts[i];
+			}
+			assert(chunkCount == stats.chunkCount);
+			assert(usedCount == stats.allocCount + stats.cachedCount);
+			assert(stats.GetFragmentation() >= 0.0 && stats.GetFragmentation() <= 1.0);
+			stats += stats;
+			assert(stats.chunkCount == 2 * chunkCount);
+		}
+
+		{
+			auto blockRelocator = [&blocks, blockSize] (void* srcBlock, void* dstBlock) noexcept
+			{
+				std::memcpy(dstBlock, srcBlock, blockSize);
+				std::memset(srcBlock, 2, blockSize);
+				*std::find(blocks.GetBegin(), blocks.GetEnd(), srcBlock) = dstBlock;
+			};
+			memPool.Compact(blockRelocator);
+			assert(memPool.GetAllocateCount() == blocks.GetCount());
+			momo::MemPoolStatistics stats = memPool.GetStatistics();
+			assert(stats.cachedCount == 0 || memPool.GetBlockCount() == 1);
+			assert(stats.chunkCount <= stats.minChunkCount + 1 || memPool.GetBlockCount() == 1);
+			for (void* block : blocks)
+			{
+				assert(static_cast<unsigned char*>(block)[0] == 1);
+				assert(static_cast<unsigned char*>(block)[blockSize - 1] == 1);
+			}
 		}
 
 		if (memPool.CanDeallocateAll())
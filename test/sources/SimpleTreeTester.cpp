@@ -16,6 +16,7 @@
 
 #include "../../include/momo/TreeSet.h"
 #include "../../include/momo/TreeMap.h"
+#include "../../include/momo/details/TreeNodeUInt32.h"
 #include "../../include/momo/MemManagerDict.h"
 #include "../../include/momo/stdish/pool_allocator.h"
 
@@ -131,6 +132,31 @@ public:
 		TreeSet set2;
 		set2 = set;
 		assert(std::equal(set.GetBegin(), set.GetEnd(), set2.GetBegin()));
+
+		momo::MemPoolStatistics stats = set.GetMemPoolStatistics();
+		assert(stats.allocCount == 1);
+		assert(stats.allocSize >= 2 * sizeof(std::string));
+		set.Clear();
+		assert(set.GetMemPoolStatistics().chunkCount == 0);
+
+		set.Compact();
+		for (size_t i = 0; i < 1000; ++i)
+			set.Insert(std::to_string(i));
+		for (size_t i = 0; i < 1000; ++i)
+		{
+			if (i % 5 != 0)
+				set.Remove(std::to_string(i));
+		}
+		stats = set.GetMemPoolStatistics();
+		set.Compact();
+		assert(set.GetMemPoolStatistics().chunkCount < stats.chunkCount);
+		assert(set.GetMemPoolStatistics().allocCount == stats.allocCount);
+		assert(set.GetCount() == 200);
+		for (size_t i = 0; i < 1000; ++i)
+			assert(set.ContainsKey(std::to_string(i)) == (i % 5 == 0));
+		for (size_t i = 0; i < 1000; ++i)
+			set.Insert(std::to_string(i));
+		assert(set.GetCount() == 1000);
 	}
 
 	template<bool useSafeValueReference>
@@ -252,6 +278,12 @@ public:
 		TestTemplTreeNode<104,  33,   3, 3, 3>(mt);
 		TestTemplTreeNode<204, 100,   2, 3, 3>(mt);
 		TestTemplTreeNode<255,   0,   1, 3, 3>(mt);
+
+		TestTemplTreeNodeUInt32<  2,  1,  true, 3, 2>(mt);
+		TestTemplTreeNodeUInt32<  5,  3, false, 1, 1>(mt);
+		TestTemplTreeNodeUInt32< 32, 64,  true, 3, 3>(mt);
+		TestTemplTreeNodeUInt32< 32, 64, false, 0, 0>(mt);
+		TestTemplTreeNodeUInt32<255,  2,  true, 2, 1>(mt);
 	}
 
 	template<size_t maxCapacity, size_t capacityStep, size_t memPoolBlockCount,
@@ -264,12 +296,38 @@ public:
 		typedef momo::TreeNode<maxCapacity, capacityStep,
 			momo::MemPoolParams<memPoolBlockCount>> TreeNode;
 
+		TestTreeNodeSet<TreeNode>(mt);
+		if (maxCapacity > 1)
+			TestTreeNodeCompact<TreeNode>();
+		TestTreeNodeMap<TreeNode, keyTraits, valueTraits>(mt);
+
+		std::cout << "ok" << std::endl;
+	}
+
+	template<size_t maxCapacity, size_t memPoolBlockCount, bool isFlatLayout,
+		size_t keyTraits, size_t valueTraits>
+	static void TestTemplTreeNodeUInt32(std::mt19937& mt)
+	{
+		std::cout << "momo::TreeNodeUInt32<" << maxCapacity << ", " << memPoolBlockCount << ", "
+			<< isFlatLayout << ">: " << std::flush;
+
+		typedef momo::TreeNodeUInt32<maxCapacity, memPoolBlockCount, isFlatLayout> TreeNode;
+
+		TestTreeNodeSet<TreeNode>(mt);
+		TestTreeNodeMap<TreeNode, keyTraits, valueTraits>(mt);
+
+		std::cout << "ok" << std::endl;
+	}
+
+	template<typename TreeNode>
+	static void TestTreeNodeSet(std::mt19937& mt)
+	{
 		static const size_t count = 256;
-		static uint8_t array[count];
+		uint8_t array[count];
 		for (size_t i = 0; i < count; ++i)
 			array[i] = static_cast<uint8_t>(i);
 
-		if (maxCapacity > 1)
+		if (TreeNode::maxCapacity > 1)
 		{
 			typedef momo::TreeTraits<uint8_t, false, TreeNode> TreeTraits;
 			typedef momo::TreeSet<uint8_t, TreeTraits, momo::MemManagerDict<>> TreeSet;
@@ -293,6 +351,42 @@ public:
 				assert(std::equal(set2.GetBegin(), set2.GetEnd(), array));
 			}
 		}
+	}
+
+	template<typename TreeNode>
+	static void TestTreeNodeCompact()
+	{
+		static const size_t count = 256;
+		uint8_t array[count];
+		for (size_t i = 0; i < count; ++i)
+			array[i] = static_cast<uint8_t>(i);
+
+		{
+			typedef momo::TreeTraits<uint8_t, false, TreeNode> TreeTraits;
+			typedef momo::TreeSet<uint8_t, TreeTraits, momo::MemManagerDict<>> TreeSet;
+
+			TreeSet set;
+			set.Insert(array, array + count);
+			for (size_t i = 0; i < count; i += 2)
+				set.Remove(array[i]);
+			size_t chunkCount = set.GetMemPoolStatistics().chunkCount;
+			set.Compact();
+			assert(set.GetMemPoolStatistics().chunkCount <= chunkCount);
+			assert(set.GetCount() == count / 2);
+			for (size_t i = 0; i < count; ++i)
+				assert(set.ContainsKey(array[i]) == (i % 2 == 1));
+			set.Insert(array, array + count);
+			assert(std::equal(set.GetBegin(), set.GetEnd(), array));
+		}
+	}
+
+	template<typename TreeNode, size_t keyTraits, size_t valueTraits>
+	static void TestTreeNodeMap(std::mt19937& mt)
+	{
+		static const size_t count = 256;
+		uint8_t array[count];
+		for (size_t i = 0; i < count; ++i)
+			array[i] = static_cast<uint8_t>(i);
 
 		{
 			typedef TemplItem<(keyTraits < 2), (keyTraits % 2 == 0)> Key;
@@ -361,8 +455,6 @@ public:
 				}
 			}
 		}
-
-		std::cout << "ok" << std::endl;
 	}
 };
 